@@ -498,6 +498,9 @@ namespace ESMCI {
       ESMC_Region_Flag zeroflag=ESMC_REGION_TOTAL,
       ESMC_TermOrder_Flag termorderflag=ESMC_TERMORDER_FREE,
       bool checkflag=false, bool haloFlag=false);
+    template<typename SIT, typename DIT>
+      static int sparseMatMulUpdateFactors(RouteHandle *routehandle,
+      std::vector<SparseMatrix<SIT,DIT> > const &sparseMatrix);
     static int sparseMatMulRelease(RouteHandle *routehandle);
     static void superVecParam(Array *array, int localDeCount,
       bool superVectorOkay, int superVecSizeUnd[3], int *superVecSizeDis[2],
@@ -20,6 +20,7 @@
 
 #include <vector>
 #include <fstream>
+#include <memory>
 
 #include "ESMCI_Util.h"
 #include "json.hpp"
@@ -72,10 +73,23 @@ enum ESMC_ISOCType {C_INT, C_LONG, C_FLOAT, C_DOUBLE, C_CHAR};
 
 //-----------------------------------------------------------------------------
 
+// Parsed form of an Info key. Keys are interned, so that the attribute names
+// used over and over (e.g. "/NUOPC/Instance/Connected") are parsed once and
+// then looked up without building a JSON pointer each time.
+struct InfoKey {
+  json::json_pointer pointer;  // Key as JSON pointer
+  std::vector<std::string> tokens;  // Unescaped reference tokens of pointer
+  static std::shared_ptr<const InfoKey> intern(key_t &key);
+};
+
+//-----------------------------------------------------------------------------
+
 void alignOffset(int &offset);
 std::size_t get_attpack_count(const json &j);
 json::iterator find_by_index(json &j, std::size_t index, bool recursive, bool attr_compliance, std::size_t *index_current = nullptr, bool *found = nullptr);
 void update_json_pointer(const json &j, json const **jdp, const json::json_pointer &key, bool recursive);
+json const * find_json(const json &j, const InfoKey &key);
+json * find_json(json &j, const InfoKey &key);
 count_map_t create_json_attribute_count_map(void);
 void update_json_attribute_count_map(count_map_t &counts, const json &j, bool first);
 bool isIn(key_t& target, const std::vector<std::string>& container);
@@ -93,6 +107,7 @@ class Info {
 
 private:
   bool dirty = false;
+  long int generation = 0;  // Counts write accesses to the storages
   json storage;  // JSON object store for keys/values managed by this instance
   json type_storage;  // JSON object for Fortran typing
 
@@ -138,8 +153,8 @@ public:
   std::vector<T> getvec(key_t &key, bool recursive = false) const;
 
   virtual const json& getStorageRef(void) const { return this->storage; }
-  virtual json& getStorageRefWritable(void) { return this->storage; }
-  json& getTypeStorageWritable(void) { return this->type_storage; }
+  virtual json& getStorageRefWritable(void) { ++this->generation; return this->storage; }
+  json& getTypeStorageWritable(void) { ++this->generation; return this->type_storage; }
   const json& getTypeStorage(void) const { return this->type_storage; }
 
   json const * getPointer(key_t &key, bool recursive = false) const;
@@ -150,6 +165,10 @@ public:
   json inquire(key_t& key, bool recursive = false, const int *idx = nullptr,
     bool attr_compliance = false) const;
 
+  // Changes whenever the storages may have been modified. Lets callers
+  // detect changes since they last looked, independent of the dirty flag.
+  long int getGeneration() const {return this->generation;}
+
   bool isDirty() const {return this->dirty;}
   void setDirty(bool flag) {this->dirty = flag;}
 
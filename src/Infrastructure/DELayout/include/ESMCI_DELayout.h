@@ -373,6 +373,19 @@ class XXE{
         vectorLengthMultiplier = vectorLengthMultiplier_;
       }
     };
+
+    struct FactorSlot{
+      // The FactorSlot records where in the factorList of a productSum stream
+      // element the factor of a specific (src, dst) sequence index pair was
+      // placed. This allows the factors of a stored sparse matrix to be
+      // changed in place, without recomputing the communication pattern.
+      ESMC_I8 srcSeqIndex;          // src decomp sequence index
+      ESMC_I8 dstSeqIndex;          // dst decomp sequence index
+      int srcTensorSeqIndex;        // src tensor sequence index
+      int dstTensorSeqIndex;        // dst tensor sequence index
+      void *factor;                 // location of the factor in factorList
+      TKId factorTK;                // typekind of the factor
+    };
     
   public:
     VM *vm;
@@ -410,6 +423,10 @@ class XXE{
     // MISC
     int lastFilterBitField;         // filterBitField during last exec() call
     bool superVectorOkay;           // flag to indicate that super-vector okay
+    // FACTOR SLOTS
+    bool factorSlotsFlag;           // flag to indicate factor slots recorded
+    std::vector<FactorSlot> factorSlots;  // factor slots of this XXE object,
+                                    // not including those of the xxeSubList
   private:
     int max;                        // maximum number of elements in stream
     int dataMaxCount;               // maximum number of elements in data
@@ -436,6 +453,7 @@ class XXE{
       bufferInfoList.reserve(20000);  // initial preparation
       lastFilterBitField = 0x0;
       superVectorOkay = true;
+      factorSlotsFlag = false;
       rh = NULL;
     }
     XXE(std::stringstream &streami,
@@ -445,7 +463,7 @@ class XXE{
     ~XXE();      // destructor
     void clearReset(int countArg, int dataCountArg=-1, 
       int commhandleCountArg=-1, int xxeSubCountArg=-1, 
-      int bufferInfoListArg=-1);
+      int bufferInfoListArg=-1, int factorSlotCountArg=-1);
     void streamify(std::stringstream &streami);
     bool getNextSubSuperVectorOkay(SubRecursiveSearch &look){
       // Search for the next "actual" xxeSub element in the opstream, that is
@@ -508,6 +526,28 @@ class XXE{
     int incCommhandleCount();
     int incXxeSubCount();
     
+    void recordFactorSlot(ESMC_I8 srcSeqIndex, int srcTensorSeqIndex,
+      ESMC_I8 dstSeqIndex, int dstTensorSeqIndex, void *factor,
+      TKId factorTK){
+      // record the location of a factor that was placed into a factorList
+      if (!factorSlotsFlag) return;
+      FactorSlot slot;
+      slot.srcSeqIndex = srcSeqIndex;
+      slot.srcTensorSeqIndex = srcTensorSeqIndex;
+      slot.dstSeqIndex = dstSeqIndex;
+      slot.dstTensorSeqIndex = dstTensorSeqIndex;
+      slot.factor = factor;
+      slot.factorTK = factorTK;
+      factorSlots.push_back(slot);
+    }
+    void getFactorSlots(std::vector<FactorSlot *> &slotList){
+      // collect the factor slots of this XXE and all of its xxeSubList
+      for (unsigned i=0; i<factorSlots.size(); i++)
+        slotList.push_back(&(factorSlots[i]));
+      for (int i=0; i<xxeSubCount; i++)
+        if (xxeSubList[i]) xxeSubList[i]->getFactorSlots(slotList);
+    }
+    
     int storeData(char *data, unsigned long size);
     int storeCommhandle(VMK::commhandle **commhandle);
     int storeXxeSub(XXE *xxeSub);
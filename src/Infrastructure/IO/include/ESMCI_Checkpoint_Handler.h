@@ -0,0 +1,147 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+//
+//-------------------------------------------------------------------------
+// (all lines below between the !BOP and !EOP markers will be included in
+//  the automated document processing.)
+//-------------------------------------------------------------------------
+// these lines prevent this file from being read more than once if it
+// ends up being included multiple times
+
+#ifndef __ESMCI_CHECKPOINT_HANDLER_H
+#define __ESMCI_CHECKPOINT_HANDLER_H
+
+//-------------------------------------------------------------------------
+//BOPI
+// !CLASS: ESMCI::Checkpoint_Handler - IO
+//
+// !DESCRIPTION:
+//
+// The code in this file defines the C++ {\tt Checkpoint\_Handler} members
+// and method signatures (prototypes).  The companion file
+// {\tt ESMCI\_Checkpoint\_Handler.C} contains the full code (bodies) for the
+// {\tt Checkpoint\_Handler} methods.
+// {\tt Checkpoint\_Handler} is derived from the {\tt IO\_Handler}
+// base class. It implements the native ESMF checkpoint format
+// (ESMF_IOFMT_CHECKPOINT): every PET writes the exclusive region of each of
+// its DEs as one block of a shared file, and an index of all the blocks is
+// kept at the end of the file.
+//
+//EOPI
+//-------------------------------------------------------------------------
+
+#include "ESMCI_VM.h"
+#include "ESMCI_Array.h"
+#include "ESMC_Util.h"
+#include "ESMCI_IO_Handler.h"       // IO_Handler is superclass to Checkpoint_Handler
+
+#include <string>
+#include <vector>
+
+//-------------------------------------------------------------------------
+
+namespace ESMCI {
+
+  // classes and structs
+
+  class Checkpoint_Handler;
+
+  // class definitions
+
+  //===========================================================================
+  class Checkpoint_Handler : public IO_Handler {    // inherits from IO_Handler class
+
+  private:
+
+    // One block of a variable: the exclusive region of one DE
+    struct Block {
+      int flags;                  // CKPT_BLOCK_* flags
+      ESMC_I8 offset;             // file offset of the data
+      ESMC_I8 storedBytes;        // size of the data in the file
+      ESMC_I8 rawBytes;           // size of the uncompressed data
+      std::vector<int> lbound;    // index space box of the block, per Array dim
+      std::vector<int> ubound;
+    };
+    // A block of a local DE, with its place in the LocalArray
+    struct LocalBlock {
+      int localDe;
+      std::vector<int> lbound;    // index space box, as in Block
+      std::vector<int> ubound;
+      std::vector<int> counts;    // shape of the LocalArray
+      std::vector<int> offset;    // start of the box in the LocalArray
+    };
+    struct Variable {
+      std::string name;
+      int timeslice;
+      int typekind;
+      int rank;
+      std::vector<Block> blocks;  // in PET order, then local DE order
+    };
+    // The file of one tile
+    struct TileFile {
+      int fd;
+      bool readonly;
+      bool dirty;                 // index needs to be written
+      ESMC_I8 dataEnd;            // end of the data blocks (start of the index)
+      std::vector<Variable> vars;
+    };
+    std::vector<TileFile> files;
+    VM *vm;                       // VM of the PETs sharing the open files
+    int my_rank;
+    bool compress;                // try to compress the blocks
+
+  public:
+    // native constructor and destructor
+    Checkpoint_Handler(ESMC_IOFmt_Flag fmtArg, int ntilesArg, int *rc);
+    ~Checkpoint_Handler() { destruct(); }
+  private:
+    void destruct(void);
+  public:
+
+    // read()
+    // Non-atomic reads which are only successful on an open IO stream
+    void arrayReadOneTileFile(Array *arr_p, int tile, const char * const name,
+                              int *timeslice = NULL, int *rc = NULL);
+
+    // write()
+    // Non-atomic writes which are only successful on an open IO stream
+    void arrayWriteOneTileFile(Array *arr_p, int tile, const char * const name,
+                               const std::vector<std::string> &dimLabels,
+                               int *timeslice = NULL,
+                               const ESMCI::Info *varAttPack = NULL,
+                               const ESMCI::Info *gblAttPack = NULL,
+                               const IO_VarOptions *varOptions = NULL,
+                               int *rc = NULL);
+
+    // Arrays are written and read with any number of DEs per PET and
+    // with undistributed dimensions
+    bool acceptsAnyLayout(void) { return true; }
+
+    // open() and close()
+    void openOneTileFile(int tile, bool readonly_arg, int *rc = NULL);
+    ESMC_Logical isOpen(int tile);
+    void flushOneTileFile(int tile, int *rc = NULL);
+    void closeOneTileFile(int tile, int *rc = NULL);
+
+  private:
+    int getLocalBlocks(Array *arr_p, int tile,
+                       std::vector<LocalBlock> &localBlocks);
+    Variable *findVariable(int tile, const std::string &name, int timeslice);
+    int readBlockData(int tile, const Block &block, int elemSize,
+                      ESMC_I8 first, ESMC_I8 last,
+                      std::vector<char> &buffer, ESMC_I8 *bias);
+    int readIndex(int tile);
+    int writeIndex(int tile);
+  };  // class Checkpoint_Handler
+  //===========================================================================
+
+} // namespace ESMCI
+
+#endif // __ESMCI_CHECKPOINT_HANDLER_H
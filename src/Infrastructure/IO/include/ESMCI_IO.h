@@ -249,8 +249,14 @@ namespace ESMCI {
     void redist_arraycreate1de(Array *src_array_p, Array **dst_array_p, int petCount, int *rc);
     bool undist_check(Array *array_p, int *rc);
     void undist_arraycreate_alldist(Array *src_array_p, Array **dst_array_p, int *rc);
+    void undist_distgridcreate_alldist(Array *src_array_p, DistGrid **dst_distgrid_p, int *rc);
+    void undist_arraycreate_alldist(Array *src_array_p, DistGrid *alldist_distgrid_p,
+        Array **dst_array_p, int *rc);
     void clear();
 
+    // Drop the temporary Arrays and RouteHandles kept between writes
+    static void finalize();
+
 // TBI
 #if 0
     int print() const;
@@ -54,6 +54,34 @@ namespace ESMCI {
 
   class IO_Handler;
 
+  // Storage settings of a variable in a NetCDF-4 file. They are taken from
+  // the Info of the Array being written, under /ESMF/IO:
+  //   deflateLevel      - int 1..9, zlib compression level (0 = off)
+  //   shuffle           - bool, byte shuffle filter before compression
+  //   chunkSizes        - int list, chunk extent per dimension in Array
+  //                       dimension order (the time dimension is chunked
+  //                       by 1)
+  //   chunkDEBlocks     - bool, chunks the size of the largest DE block
+  //   significantDigits - int, floating point values are rounded to this
+  //                       many significant decimal digits before writing
+  //                       so that they compress better (bit rounding)
+  // Other formats ignore them.
+  struct IO_VarOptions {
+    int deflateLevel;
+    bool shuffle;
+    std::vector<int> chunkSizes;
+    bool chunkDEBlocks;
+    int significantDigits;
+
+    IO_VarOptions() : deflateLevel(0), shuffle(false), chunkDEBlocks(false),
+      significantDigits(0) { }
+    bool empty(void) const {
+      return (deflateLevel <= 0) && !shuffle && chunkSizes.empty() &&
+        !chunkDEBlocks && (significantDigits <= 0);
+    }
+    static IO_VarOptions fromInfo(const ESMCI::Info *info, int *rc = NULL);
+  };
+
   // class definitions
   
   //===========================================================================
@@ -85,7 +113,9 @@ namespace ESMCI {
     static IO_Handler *create(const std::string& file,
                               ESMC_IOFmt_Flag iofmt, int ntiles, int *rc = NULL);
     static int destroy(IO_Handler **io);
+    static bool initializeIOServer(int *rc = NULL);
     static void finalize(int *rc = NULL);
+    static void quiesce(void);
   private:
     virtual void destruct(void) { }
 
@@ -102,6 +132,7 @@ namespace ESMCI {
                                        int *timeslice = NULL,
                                        const ESMCI::Info *varAttPack = NULL,
                                        const ESMCI::Info *gblAttPack = NULL,
+                                       const IO_VarOptions *varOptions = NULL,
                                        int *rc = NULL) = 0;
   public:
 
@@ -117,8 +148,22 @@ namespace ESMCI {
                     int *timeslice = NULL,
                     const ESMCI::Info *varAttPack = NULL,
                     const ESMCI::Info *gblAttPack = NULL,
+                    const IO_VarOptions *varOptions = NULL,
                     int *rc = NULL);
 
+    // Batched writes: after beginArrayWrites(), a handler may defer writing
+    // the data of arrayWrite() calls until endArrayWrites() (or a flush or
+    // close of the file) so that it can write them together.
+    virtual void beginArrayWrites(void) { }
+    virtual void endArrayWrites(int *rc = NULL) {
+      if (rc != NULL) *rc = ESMF_SUCCESS;
+    }
+
+    // true if arrayRead()/arrayWrite() take Arrays with any number of DEs
+    // per PET and with undistributed dimensions (otherwise IO redistributes
+    // to one DE per PET and aliases all dimensions as distributed first)
+    virtual bool acceptsAnyLayout(void) { return false; }
+
     // get() and set()
   public:
     const char *getName(void) const { return "ESMCI::IO_Handler"; }
@@ -170,6 +215,8 @@ namespace ESMCI {
               int *rc = NULL);
     ESMC_Logical isOpenAnyTile(void);
     virtual ESMC_Logical isOpen(int tile) { return ESMF_FALSE; }
+    // true if close() returns before the data is flushed and the file closed
+    virtual bool isCloseAsync(void) { return false; }
     void flush(int *rc = NULL);
     void close(int *rc = NULL);
 
@@ -69,6 +69,16 @@ namespace ESMCI {
 
     // global information
     static std::vector<int> activePioInstances;
+    // Settings of activePioInstances, used to find an instance to reuse
+    struct PioInstanceInfo {
+      MPI_Group group;  // the PETs of the instance, in order
+      int num_iotasks;
+      int stride;
+      int rearr;
+      int base;
+      bool ioServer;    // I/O is done by the I/O server PETs
+    };
+    static std::vector<PioInstanceInfo> activePioInstanceInfo;
     int pioSystemDesc; // Descriptor for initialized PIO inst.
     int *pioFileDesc;  // Descriptor(s) for open PIO file (typically just one, but multiple for I/O of multi-tile arrays)
     MPI_Comm communicator;
@@ -78,6 +88,20 @@ namespace ESMCI {
     int rearr;
     int base;
     bool *new_file; // Typically just one value, but multiple for I/O of multi-tile arrays
+    // Array data waiting to be written with one PIOc_write_darray_multi()
+    struct PendingWrite {
+      int tile;
+      int iodesc;
+      bool record;              // variables have a time dimension
+      int arraylen;             // local length of each variable
+      std::vector<int> varids;
+      std::vector<int> frames;
+      std::vector<char> data;   // arraylen values per variable
+      std::vector<char> fill;   // fill value per variable
+    };
+    bool batchWrites;           // between beginArrayWrites()/endArrayWrites()
+    std::vector<PendingWrite> pendingWrites;
+    ESMC_I8 pendingBytes;
 
   public:
     // native constructor and destructor
@@ -86,11 +110,13 @@ namespace ESMCI {
     static void initialize(int comp_rank, MPI_Comm comp_comm,
                            int num_iotasks, 
                            int stride, int rearr, int *base_p, int *rc = NULL);
-// Deferred for when intercom support is desired
-//    static PIO_Handler *initialize(int component_count, MPI_Comm peer_comm,
-//                                   MPI_Comm *comp_comms, MPI_Comm io_comm,
-//                                   int *rc = NULL);
+    // Hand the I/O of the global VM to the I/O server PETs
+    static bool initializeIOServer(int *rc = NULL);
     static void finalize(int *rc = NULL);
+    // Complete the file closes running in the background
+    static void asyncWait(int *rc = NULL);
+    // Complete the background work before netCDF is used outside of PIO
+    static void quiesce(void);
     // Be able to see if PIO is initialized
     static ESMC_Logical isPioInitialized(void);
     // Non-static member for default initialization
@@ -113,7 +139,10 @@ namespace ESMCI {
                                int *timeslice = NULL,
                                const ESMCI::Info *varAttPack = NULL,
                                const ESMCI::Info *gblAttPack = NULL,
+                               const IO_VarOptions *varOptions = NULL,
                                int *rc = NULL);
+    void beginArrayWrites(void);
+    void endArrayWrites(int *rc = NULL);
 
     // get() and set()
   public:
@@ -136,6 +165,7 @@ namespace ESMCI {
     }
     void flushOneTileFile(int tile, int *rc = NULL);
     void closeOneTileFile(int tile, int *rc = NULL);
+    bool isCloseAsync(void);
 
   private:
     int getIODesc(int iosys, Array *arr_p, int tile,
@@ -146,6 +176,16 @@ namespace ESMCI {
                             int *basepiotype = (int *)NULL,
                             int *rc = (int *)NULL);
     void attPackPut (int vardesc, const ESMCI::Info *attPack, int tile, int *rc);
+    void defineVarStorage(int filedesc, int vardesc, Array *arr_p, int tile,
+                          const int *ioDims, int nSpaceDims, bool record,
+                          const IO_VarOptions &opts, int *rc);
+    void queueWrite(int tile, int vardesc, int iodesc, bool record, int frame,
+                    int elemSize, const void *baseAddress, int arrlen, int *rc);
+    void writePending(int tile, int *rc);
+    // Find an active instance with the given settings (0 if none)
+    static int findInstance(MPI_Comm comp_comm, int num_iotasks,
+                            int stride, int rearr, int base);
+    static int findIOServerInstance(MPI_Comm comp_comm);
 
   public:
     // Error recording routine
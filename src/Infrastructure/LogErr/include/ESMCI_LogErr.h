@@ -135,6 +135,7 @@ private:
     void Open(const std::string &filename);
     int Set(int flush);
     int SetTrace(bool traceflag);
+    int SetFlush(bool flushflag);
     int Write(const std::string& msg, int msgtype);
     int Write(const std::stringstream& msg, int msgtype) {
       return Write(msg.str(), msgtype);
@@ -145,6 +146,8 @@ private:
         int LINE, const std::string &FILE, const std::string &method) {
       return Write(msg.str(), msgtype, LINE, FILE, method);
     }
+    int Drain();
+    int Flush();
 
 // !PUBLIC Variables:
     std::FILE *ESMC_LogFile;
@@ -171,6 +174,13 @@ extern "C" {
                             int *line, const char *file, const char *method, int *rc,
                             ESMCI_FortranStrLenArg mlen, ESMCI_FortranStrLenArg flen,
                             ESMCI_FortranStrLenArg mdlen);
+ void FTN_X(f_esmf_logwrite2)(const char *msg, int *msgtype, int *located,
+                            int *line, const char *file, const char *method,
+                            int *timevals, double *wtime, int *rc,
+                            ESMCI_FortranStrLenArg mlen, ESMCI_FortranStrLenArg flen,
+                            ESMCI_FortranStrLenArg mdlen);
+ void FTN_X(f_esmf_logdrained)(int *rc);
+ void FTN_X(f_esmf_logflush)(int *rc);
 }
 
 //EOP
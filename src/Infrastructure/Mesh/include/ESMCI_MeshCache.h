@@ -0,0 +1,36 @@
+// $Id$
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+//
+//-----------------------------------------------------------------------------
+#ifndef ESMCI_MeshCache_h
+#define ESMCI_MeshCache_h
+
+#include <string>
+
+namespace ESMCI {
+
+class Mesh;
+
+  // A mesh cache is a set of binary files, one per PET, named
+  // fbase.<petCount>.<rank>, holding the committed local piece of a Mesh:
+  // the nodes (with their owners), the elements and their connectivity,
+  // the nodal and element fields and the split element information.
+
+  // Write the local piece of a committed Mesh. Not collective.
+  void WriteMeshCache(Mesh *mesh, const std::string &fbase);
+
+  // Rebuild a Mesh from the cache files written with the same number of
+  // PETs. Collective: returns false on every PET (and creates no Mesh)
+  // unless every PET finds and reads a valid file.
+  bool ReadMeshCache(const std::string &fbase, Mesh **_mesh);
+
+} //namespace
+
+#endif
@@ -0,0 +1,88 @@
+// $Id$
+//
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+//
+//==============================================================================
+
+//==============================================================================
+//
+// This file contains the Fortran interface code to link F90 and C++.
+//
+//------------------------------------------------------------------------------
+// INCLUDES
+//------------------------------------------------------------------------------
+
+#ifndef ESMCI_SCRIP_UTIL_H
+#define ESMCI_SCRIP_UTIL_H
+
+#include <string>
+#include <ostream>
+#include <iterator>
+
+#include "ESMCI_Macros.h"
+#include "ESMCI_F90Interface.h"
+#include "ESMCI_LogErr.h"
+#include "ESMCI_VM.h"
+#include "ESMCI_CoordSys.h"
+#include "ESMCI_Array.h"
+#include "ESMCI_DistGrid.h"
+
+#include "Mesh/include/ESMCI_Mesh.h"
+
+// These internal functions can only be used if PIO is available
+#ifdef ESMF_PIO
+
+#include <pio.h>
+
+//-----------------------------------------------------------------------------
+ // leave the following line as-is; it will insert the cvs ident string
+ // into the object file for tracking purposes.
+// static const char *const version = "$Id$";
+//-----------------------------------------------------------------------------
+
+
+using namespace ESMCI;
+
+
+void get_gridSize_from_SCRIP_file(int pioFileDesc, char *filename, PIO_Offset &gridSize);
+
+void get_gridCorners_from_SCRIP_file(int pioFileDesc, char *filename, PIO_Offset &gridCorners);
+
+void get_gridDims_from_SCRIP_file(int pioFileDesc, char *filename, PIO_Offset &gridRank, int *gridDims);
+
+void get_cornerCoords_from_SCRIP_file(int pioSystemDesc, int pioFileDesc, char *filename,
+                                      PIO_Offset gridSize, PIO_Offset gridCorners,
+                                      int num_elems, int *elem_ids,
+                                      double *&cornerCoords);
+
+void get_elementMask_from_SCRIP_file(int pioSystemDesc, int pioFileDesc, char *filename,
+                                     PIO_Offset gridSize,
+                                     int num_elems, int *elem_ids,
+                                     int *&elementMask);
+
+void get_elementArea_from_SCRIP_file(int pioSystemDesc, int pioFileDesc, char *filename,
+                                     PIO_Offset gridSize,
+                                     int num_elems, int *elem_ids,
+                                     int &areaPresent, double *&elementArea);
+
+void get_centerCoords_from_SCRIP_file(int pioSystemDesc, int pioFileDesc, char *filename,
+                                      PIO_Offset gridSize,
+                                      int num_elems, int *elem_ids,
+                                      int &centerCoordsPresent, double *&centerCoords);
+
+void get_node_info_for_SCRIP_corners(ESMCI::VM *vm, int num_corners, double *cornerCoords,
+                                     int *cornerNodeIds, double *cornerNodeCoords);
+
+void convert_SCRIP_corners_to_elem_conn(char *filename, int num_elems, PIO_Offset gridCorners,
+                                        int *cornerNodeIds,
+                                        int &totNumElementConn, int *&numElementConn, int *&elementConn);
+
+#endif // ifdef ESMF_PIO
+
+#endif // ESMCI_SCRIP_UTIL_H
@@ -24,6 +24,7 @@ namespace ESMCI {
 
 class BBox;
 class _field;
+class HilbertSFC;
         
 class GeomRend {
 public:
@@ -62,6 +63,14 @@ public:
   void Build(UInt nsrcF, MEField<> **srcF, UInt ndstF, MEField<> **dstF, Zoltan_Struct **zzp, bool free_zz);
   void Build_Merge(UInt nsrcF, MEField<> **srcF, UInt ndstF, MEField<> **dstF, Zoltan_Struct **zzp);
 
+  /*
+   * Drop everything that refers to the meshes and point lists the
+   * rendezvous was built from (the communication registers and the
+   * pointers), so that the rendezvous can outlive them.  Only the
+   * rendezvous meshes, point lists and fields are usable afterwards.
+   */
+  void Detach();
+
   struct ZoltanUD {
   ZoltanUD(UInt _sdim, MEField<> *_coord_src, MEField<> *_coord_dst,PointList *_src_pointlist, PointList *_dst_pointlist, bool _iter_is_obj) :
       coord_src(_coord_src),
@@ -120,6 +129,20 @@ private:
 
   void build_src_mig(Zoltan_Struct *zz, ZoltanUD &zud);
 
+  // Space filling curve rendezvous (alternative to the Zoltan RCB one)
+  void build_sfc(HilbertSFC &sfc, ZoltanUD &zud);
+
+  void build_src_mig_sfc(const HilbertSFC &sfc, ZoltanUD &zud);
+
+  void build_dst_mig_sfc(const HilbertSFC &sfc, ZoltanUD &zud);
+
+  // Add the source elements in mignode (and their neighbors if needed)
+  // to the source migration
+  void add_src_mig(std::vector<CommRel::CommNode> &mignode);
+
+  // Add the destination objects in mignode to the destination migration
+  void add_dst_mig(std::vector<CommRel::CommNode> &mignode);
+
   void build_dst_mig_all_overlap(ZoltanUD &zud);
 
   void build_src_mig_plist(ZoltanUD &zud, int numExport,
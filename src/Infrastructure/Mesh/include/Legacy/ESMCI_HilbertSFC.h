@@ -0,0 +1,98 @@
+// $Id$
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+//
+//-----------------------------------------------------------------------------
+#ifndef ESMCI_HilbertSFC_h
+#define ESMCI_HilbertSFC_h
+
+#include <Mesh/include/Legacy/ESMCI_MeshTypes.h>
+
+#include <vector>
+
+namespace ESMCI {
+
+/**
+ * Partition of space into contiguous ranges of a Hilbert space filling
+ * curve, one range per processor.
+ *
+ * Coordinates are scaled into a 2^bits grid (per dimension) over a global
+ * bounding box and mapped to a Hilbert key.  The processor ranges are chosen
+ * by a parallel sample sort of the keys of the points which are partitioned,
+ * so each processor ends up with about the same number of points.
+ *
+ * A point belongs to exactly one processor (GetProc).  A box (e.g. an
+ * element bounding box) is assigned to every processor whose range
+ * intersects one of the curve ranges covering the box (GetBoxProcs); the box
+ * is therefore always sent to the owner of any point inside it.
+ */
+class HilbertSFC {
+public:
+
+  typedef unsigned long long Key;
+
+  /*
+   * Set up the key mapping for points in the box [cmin, cmax] (should be
+   * the same on all processors).  Points outside the box are clamped onto
+   * it.
+   */
+  HilbertSFC(UInt sdim, const double cmin[], const double cmax[]);
+
+  UInt dimension() const { return sdim; }
+
+  // Bits of resolution per dimension
+  UInt bits() const { return nbits; }
+
+  // Key of point c
+  Key GetKey(const double c[]) const;
+
+  /*
+   * Compute the processor ranges.  Collective; keys are this processor's
+   * point keys (any order).  Each processor's range holds about
+   * (global number of keys)/Par::Size() points.
+   */
+  void Partition(UInt nkeys, const Key keys[]);
+
+  // Owner of a point (Partition must have been called)
+  UInt GetProc(const double c[]) const;
+
+  UInt GetKeyProc(Key key) const;
+
+  /*
+   * The processors whose ranges intersect the box [bmin, bmax].  The box
+   * is covered by at most 2^sdim aligned cells of the curve (each one a
+   * contiguous key range), so boxes spanning a range boundary are sent to
+   * all of the processors involved.
+   */
+  void GetBoxProcs(const double bmin[], const double bmax[],
+                   std::vector<UInt> &procs) const;
+
+  // First key owned by each processor
+  const std::vector<Key> &GetSplitters() const { return splitters; }
+
+private:
+
+  // Coordinate to grid index
+  Key quantize(UInt d, double x) const;
+
+  // Hilbert key of grid coordinates (modifies X)
+  Key hilbert_key(Key X[]) const;
+
+  UInt sdim;
+  UInt nbits;
+  double origin[3];
+  double scale;
+
+  // splitters[p] is the first key owned by processor p
+  std::vector<Key> splitters;
+};
+
+} // namespace
+
+#endif
@@ -25,11 +25,13 @@
 #include <vector>
 #include <ostream>
 #include <map>
+#include <memory>
 
 namespace ESMCI {
   
 class CommRel;
 class MeshObj;
+class RegridContext;
 
 /*
  * Provides interpolation for serial and parallel meshes.  For 
@@ -148,6 +150,8 @@ public:
   /* 
    * Build the interpolation object.  The MEFields must be compatible in the
    * sense that they are all element based, or node based, etc...
+   * If rctxt is given, a parallel rendezvous is looked up in (and added
+   * to) that context instead of always being rebuilt.
    */
   Interp(Mesh *src, PointList *srcplist, Mesh *dest, PointList *destplist, Mesh *midmesh, bool freeze_dst_, int imethod,
          bool set_dst_status, WMat &dst_status,
@@ -155,7 +159,8 @@ public:
          int unmappedaction=ESMCI_UNMAPPEDACTION_ERROR, 
          bool checkFlag=false, 
          int num_src_pnts=1, 
-         ESMC_R8 dist_exponent=2.0);
+         ESMC_R8 dist_exponent=2.0,
+         RegridContext *rctxt=NULL);
 
   ~Interp();
   
@@ -174,7 +179,7 @@ public:
   void release_zz() { if(zz) Zoltan_Destroy(&zz); zz = 0; }
   Zoltan_Struct * get_zz()  { return zz; }
   SearchResult & get_sres() { return sres; }
-  GeomRend & get_grend()    { return grend; }
+  GeomRend & get_grend()    { return *grend; }
   
   private:
 
@@ -189,7 +194,8 @@ public:
   void interpL2csrvM_parallel(IWeights &, IWeights *, MEField<> const * const, MEField<> const * const);
 
   SearchResult sres;
-  GeomRend grend;
+  // (may be shared with a RegridContext)
+  std::shared_ptr<GeomRend> grend;
   bool is_parallel;
   std::vector<MEField<>*> srcF;
   std::vector<MEField<>*> dstF;
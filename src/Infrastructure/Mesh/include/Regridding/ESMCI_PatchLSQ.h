@@ -0,0 +1,74 @@
+// $Id$
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+//
+//-----------------------------------------------------------------------------
+#ifndef ESMCI_PatchLSQ_h
+#define ESMCI_PatchLSQ_h
+
+#include <Mesh/include/Legacy/ESMCI_MeshTypes.h>
+
+#include <vector>
+
+namespace ESMCI {
+
+/**
+ * Batched pseudo inverses of the small least squares systems used by
+ * patch recovery.
+ *
+ * Systems are queued with Add() and all solved by Solve().  Systems of the
+ * same size are grouped and factored together with Householder QR, several
+ * at a time with the matrices interleaved so the inner loops run across
+ * systems (and vectorize).  The groups are split over OpenMP threads.
+ *
+ * A system only gets a pseudo inverse here when it is full rank with a
+ * condition number (bounded by ||R||_F ||R^-1||_F) below 1/rcond.  For
+ * those, the rank revealing dgelsd solve would not truncate anything and
+ * gives the same result.  For the others (or m < n) GetPinv() returns NULL
+ * and the caller should use dgelsd.
+ */
+class PatchLSQBatch {
+public:
+
+  PatchLSQBatch(double _rcond);
+
+  // Queue the (m x n, column major) system A; returns its id
+  UInt Add(int m, int n, const double A[]);
+
+  UInt NumSystems() const { return sys_m.size(); }
+
+  // Compute the pseudo inverses of all queued systems
+  void Solve();
+
+  /*
+   * The (n x m, column major) pseudo inverse of system id, or NULL if the
+   * system wasn't solved here.  Solve() must have been called.
+   */
+  const double *GetPinv(UInt id) const;
+
+  void clear();
+
+private:
+
+  double rcond;
+  bool solved;
+
+  std::vector<int> sys_m, sys_n;
+
+  // Offset of each system in mats (and pinvs)
+  std::vector<std::size_t> sys_off;
+
+  std::vector<double> mats;
+  std::vector<double> pinvs;
+  std::vector<char> sys_ok;
+};
+
+} // namespace
+
+#endif
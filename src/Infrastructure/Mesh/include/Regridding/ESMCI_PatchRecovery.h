@@ -19,6 +19,7 @@
 #include <Mesh/include/Legacy/ESMCI_MasterElement.h>
 #include <Mesh/include/Legacy/ESMCI_Exception.h>
 #include <Mesh/include/Legacy/ESMCI_MCoord.h>
+#include <Mesh/include/Regridding/ESMCI_PatchLSQ.h>
 
 #include <map>
 
@@ -58,6 +59,26 @@ void CreatePatch(UInt pdeg,
            MEField<> *src_mask_ptr=NULL
            );
 
+/*
+ * CreatePatch in two steps, so the least squares solves of many patches
+ * can be done together: AssemblePatch sets up the system and queues it
+ * on batch, then after batch.Solve() FinishPatch computes the
+ * coefficients.  The patch can't be evaluated in between.
+ */
+void AssemblePatch(UInt pdeg,
+           const MeshDB &mesh,
+           const MeshObj &node,
+           UInt numfields,
+           NFIELD **rfield,
+           UInt threshold,
+           const MEField<> &coord,
+           const MCoord *_mc,
+           MEField<> *src_mask_ptr,
+           PatchLSQBatch &batch
+           );
+
+void FinishPatch(const PatchLSQBatch &batch);
+
 // field = linearized field index
 Real EvalPatch(UInt nfield, const double coords[]) const;
 
@@ -73,6 +94,12 @@ private:
           UInt dim, std::vector<double> &mat, double coord[],
                           std::vector<Real> &rhs, const Real fvals[], UInt fdim);
 UInt get_ncoeff(UInt dim, UInt deg);
+// Set up the least squares system; returns false if the patch is bad
+bool assemble(UInt pdeg, const MeshDB &mesh, const MeshObj &node,
+          UInt numfields, NFIELD **rfield, UInt threshold,
+          const MEField<> &coord, const MCoord *_mc, MEField<> *src_mask_ptr,
+          std::vector<double> &mat, std::vector<Real> &rhs,
+          int &m, int &ldb, int &nrhs);
 UInt pdeg;
 UInt idim;
 UInt ncoeff;
@@ -80,6 +107,11 @@ bool patch_ok;
 std::vector<Real> coeff;
 MCoord mc;
 bool use_mc;
+// System waiting on a PatchLSQBatch (lsq_id < 0 if none)
+int lsq_id;
+int lsq_m, lsq_ldb, lsq_nrhs;
+std::vector<double> lsq_mat;
+std::vector<Real> lsq_rhs;
 };
 
 // An object that wraps a patchrecov for each node of an element and
@@ -107,6 +139,25 @@ void CreateElemPatch(UInt pdeg,
            bool boundary_ok = false // if true, forms the patch with boundary nodes that have >= 2 elems
            );
 
+/*
+ * CreateElemPatch in two steps, queueing the least squares systems of the
+ * nodal patches on batch (see PatchRecov::AssemblePatch).  Call
+ * FinishElemPatch after batch.Solve(), before evaluating.
+ */
+void AssembleElemPatch(UInt pdeg,
+           UInt ptype,
+           const MeshObj &elem,
+           const MEField<> &cfield,
+           MEField<> *src_mask_ptr,
+           UInt numfields,
+           NFIELD **rfield,
+           UInt threshold,
+           PatchLSQBatch &batch,
+           bool boundary_ok = false
+           );
+
+void FinishElemPatch(const PatchLSQBatch &batch);
+
 /**
  * Evaluate the function at the given parametric coordinates
  * results(npts*allfieldsize) // value at the points
@@ -133,6 +184,10 @@ static void FreePatchMap(NodePatchMap &nmap);
 private:
   ElemPatch &operator=(const ElemPatch &rhs);
   ElemPatch(const ElemPatch &rhs);
+  void create_elem_patch(UInt pdeg, UInt ptype, const MeshObj &elem,
+           const MEField<> &cfield, MEField<> *src_mask_ptr,
+           UInt numfields, NFIELD **rfield, UInt threshold,
+           bool boundary_ok, PatchLSQBatch *batch);
   std::vector<PatchRecov<NFIELD,Real>*> patches;
   std::vector<MCoord> mcs;
   const MeshObj *pelem;
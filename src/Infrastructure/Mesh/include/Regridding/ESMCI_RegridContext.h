@@ -0,0 +1,125 @@
+// $Id$
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+//
+//-----------------------------------------------------------------------------
+#ifndef ESMCI_RegridContext_h
+#define ESMCI_RegridContext_h
+
+#include <Mesh/include/Legacy/ESMCI_GeomRendezvous.h>
+#include <Mesh/include/Legacy/ESMCI_MEField.h>
+#include "PointList/include/ESMCI_PointList.h"
+
+#include <list>
+#include <memory>
+
+namespace ESMCI {
+
+class Mesh;
+class VMId;
+
+/**
+ * Cache of built geometric rendezvous (the migrated source and destination
+ * meshes/point lists), so that regridding the same source and destination
+ * again (e.g. several RegridStore calls with different normalization,
+ * unmapped actions or masks) doesn't repartition and migrate the meshes.
+ *
+ * An entry is found by the rendezvous configuration, the current VM and a
+ * fingerprint of each PET's local piece of the source and destination
+ * geometry (ids, coordinates, element connectivity and field names).  A
+ * hit requires every PET to match, so all PETs either reuse or rebuild
+ * together.  The values of the fields that travel with the meshes (masks,
+ * areas, ...) are not part of the key; they are refreshed on the cached
+ * rendezvous meshes by global id on a hit.
+ *
+ * A cached rendezvous is detached from the meshes and point lists it was
+ * built from (see GeomRend::Detach()), it only holds its own migrated
+ * copies.  So an entry stays valid after the original objects are
+ * destroyed, and is hit by any later objects with the same geometry.
+ *
+ * The search is still run for every regrid, since it depends on the
+ * masks and the method.
+ *
+ * The number of cached rendezvous is set by the
+ * ESMF_RUNTIME_REGRID_CONTEXT_CACHE runtime variable (default 0, i.e.
+ * no caching, since a rendezvous holds copies of both meshes).
+ */
+class RegridContext {
+public:
+
+  RegridContext(UInt _max_entries);
+
+  ~RegridContext();
+
+  // Context used by regrid()
+  static RegridContext *Global();
+
+  // Delete the context used by regrid(), called from ESMF_Finalize()
+  static void Finalize();
+
+  /*
+   * Get a built rendezvous for these objects.  Either a cached one (with
+   * its fields refreshed from srcmesh and dstmesh), or a new one built
+   * with GeomRend::Build(), which is then added to the cache if it is
+   * complete.  Collective.
+   */
+  std::shared_ptr<GeomRend> GetRend(Mesh *srcmesh, PointList *srcplist,
+                                    Mesh *dstmesh, PointList *dstplist,
+                                    const GeomRend::DstConfig &cfg, bool on_sph,
+                                    UInt nsrcF, MEField<> **srcF,
+                                    UInt ndstF, MEField<> **dstF,
+                                    Zoltan_Struct **zzp, bool free_zz);
+
+  UInt NumEntries() const { return entries.size(); }
+
+  // Number of GetRend calls satisfied from the cache
+  UInt NumHits() const { return nhits; }
+
+  void clear();
+
+  typedef unsigned long long Fingerprint;
+
+  // Fingerprint of the geometry of the local piece of a mesh or point list
+  // (for a mesh, including the names of its fields)
+  static Fingerprint MeshFingerprint(const Mesh &mesh);
+  static Fingerprint PlistFingerprint(const PointList &plist);
+
+private:
+
+  RegridContext(const RegridContext &);
+  RegridContext &operator=(const RegridContext &);
+
+  struct Key {
+    Fingerprint src, dst;
+    bool src_is_plist, dst_is_plist;
+    UInt iter_obj_type, obj_type;
+    bool neighbors, all_overlap_dst;
+    double geom_tol;
+    bool on_sph;
+    UInt petCount;
+    std::shared_ptr<VMId> vmId;
+
+    bool operator==(const Key &rhs) const;
+  };
+
+  struct Entry {
+    Key key;
+    std::shared_ptr<GeomRend> rend;
+  };
+
+  // Most recently used first
+  std::list<Entry> entries;
+
+  UInt max_entries;
+  UInt nhits;
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,138 @@
+// $Id$
+// Earth System Modeling Framework
+// Copyright (c) 2002-2023, University Corporation for Atmospheric Research,
+// Massachusetts Institute of Technology, Geophysical Fluid Dynamics
+// Laboratory, University of Michigan, National Centers for Environmental
+// Prediction, Los Alamos National Laboratory, Argonne National Laboratory,
+// NASA Goddard Space Flight Center.
+// Licensed under the University of Illinois-NCSA License.
+
+//
+//-----------------------------------------------------------------------------
+#ifndef ESMCI_WMatCOO_h
+#define ESMCI_WMatCOO_h
+
+#include <Mesh/include/Regridding/ESMCI_WMat.h>
+
+#include <vector>
+
+namespace ESMCI {
+
+class Mesh;
+class PointList;
+
+/**
+ * Streaming weight container.  Weights are appended as (row, col)
+ * coordinate entries into one buffer per OpenMP thread and are only sorted
+ * and merged once, in Assemble().  After assembly the matrix is held in
+ * compressed row form (one sorted array of rows, one array of row offsets
+ * and one sorted array of columns), so the per row tree node and heap
+ * allocated column vector of WMat are never created.
+ *
+ * The container can migrate itself to a row decomposition the same way
+ * WMat does, but packs each destination processor's rows and columns as
+ * contiguous blocks instead of one SparsePack per map entry.  Once the
+ * weights are complete they can be moved into a WMat (for code that still
+ * expects one) or written straight into factor lists.
+ */
+class WMatCOO {
+
+public:
+
+  typedef WMat::Entry Entry;
+
+  /*
+   * How to treat entries which have the same row and column
+   * (i.e. Entry::operator== is true).
+   *   MERGE_UNIQUE: as WMat::InsertRowMergeSingle(), keep one copy and
+   *                 complain if the values differ.
+   *   MERGE_SUM:    as WMat::InsertRowSumSingle(), add the values (in
+   *                 insertion order).
+   */
+  enum MergeMode {MERGE_UNIQUE=0, MERGE_SUM};
+
+  WMatCOO(MergeMode _mode = MERGE_UNIQUE);
+
+  ~WMatCOO();
+
+  // Append entries.  May be called concurrently from different OpenMP
+  // threads, each thread appends into its own buffer.
+  void InsertRowSingle(const Entry &row, const Entry &col);
+
+  void InsertRow(const Entry &row, const std::vector<Entry> &cols);
+
+  // Move all rows of wmat into the append buffer, emptying wmat.
+  void InsertWMat(WMat &wmat);
+
+  // Sort and merge all buffered entries into compressed row form.
+  // Cheap if nothing was appended since the last call.
+  void Assemble();
+
+  // Number of (assembled) rows and matrix entries
+  UInt NumRows() const { return rows.size(); }
+
+  UInt NumEntries() const { return cols.size(); }
+
+  /*
+   * Migrate the matrix to the row decomposition given by the ids in
+   * dest_gids (rows whose id isn't requested by anyone are dropped).
+   */
+  void Migrate(UInt ndest_gids, const UInt dest_gids[]);
+
+  void Migrate(Mesh &mesh);
+  void Migrate(PointList &plist);
+  void MigrateToElem(Mesh &mesh);
+
+  /*
+   * Move the assembled weights into wmat, merging with any rows already
+   * there, and release the storage held by this object.
+   */
+  void AssembleInto(WMat &wmat);
+
+  /*
+   * Write the weights as an ESMF factor list.  iientries must have room
+   * for 2*NumEntries() ints (src, dst pairs) and factors for NumEntries().
+   */
+  void GetFactorLists(int *iientries, double *factors) const;
+
+  void clear();
+
+  // Row access after Assemble()
+  const Entry &row(UInt i) const { return rows[i]; }
+  const Entry *row_cols_begin(UInt i) const { return cols.data() + row_ptr[i]; }
+  const Entry *row_cols_end(UInt i) const { return cols.data() + row_ptr[i+1]; }
+
+private:
+
+  WMatCOO(const WMatCOO &);
+  WMatCOO &operator=(const WMatCOO &);
+
+  // Unassembled coordinate entry
+  struct Triple {
+    Entry row;
+    Entry col;
+    bool operator<(const Triple &rhs) const {
+      if (row < rhs.row) return true;
+      if (rhs.row < row) return false;
+      return col < rhs.col;
+    }
+  };
+
+  // Buffer for the calling thread
+  std::vector<Triple> &thread_buffer();
+
+  MergeMode mode;
+
+  // One append buffer per thread
+  std::vector<std::vector<Triple> > bufs;
+
+  // Compressed row storage
+  std::vector<Entry> rows;
+  std::vector<UInt> row_ptr;
+  std::vector<Entry> cols;
+
+};
+
+} // namespace
+
+#endif
@@ -143,6 +143,11 @@ class Alarm {
                                   //   Alarm::ringerOff(),
                                   //  otherwise will turn self off after
                                   //  ringDuration or ringTimeStepCount.
+    int               scheduleIndex;  // position in clock's alarmList, as of
+                                      //   the last schedule rebuild
+    unsigned          scheduleStamp;  // invalidates clock schedule entries
+    bool              scheduleActive; // checked on every clock timestep
+
     int               id;         // unique identifier. used for equality
                                   //    checks and to generate unique default
                                   //    names.
@@ -272,6 +277,12 @@ class Alarm {
     // reconstruct ringBegin during ESMF_DIRECTION_REVERSE
     int resetRingBegin(bool timeStepPositive);
 
+    // whether checkRingTime() can only change state once ringTime is reached
+    bool isIdle(void) const;
+
+    // tell the associated clock that this alarm changed outside of advance()
+    void changed(void);
+
     // friend class alarm
     friend class Clock;
 
@@ -170,6 +170,14 @@ class Calendar {
                       ESMC_I4 *d=0, ESMC_I8 *d_i8=0,
                       ESMC_R8 *d_r8=0) const;
 
+    // batch conversions of arrays of whole seconds, e.g. for time axes
+    int convertToTime(int count, const ESMC_I8 *yy, const int *mm,
+                      const int *dd, const ESMC_I8 *d, const ESMC_I8 *s,
+                      ESMC_I8 *t) const;
+    int convertToDate(int count, const ESMC_I8 *t, ESMC_I8 *yy=0,
+                      int *mm=0, int *dd=0, ESMC_I8 *d=0,
+                      ESMC_I8 *s=0) const;
+
     Time increment(const Time *time, const TimeInterval &timeinterval) const;
 
     Time decrement(const Time *time, const TimeInterval &timeinterval) const;
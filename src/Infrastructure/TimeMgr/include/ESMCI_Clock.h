@@ -69,6 +69,8 @@
 #include "ESMCI_Time.h"
 #include "ESMCI_Alarm.h"
 
+#include <vector>
+
 namespace ESMCI{
 
 // !PUBLIC TYPES:
@@ -111,6 +113,18 @@ namespace ESMCI{
                                                 //  necessary
     Alarm           **alarmList;                // associated alarm array
 
+    // Schedule of the alarms for advance() in forward direction with a
+    // positive timeStep. Idle alarms wait in a min-heap keyed by their
+    // ringTime, all other alarms are checked on every timestep.
+    struct AlarmScheduleEntry {
+      Time      ringTime;
+      Alarm    *alarm;
+      unsigned  stamp;         // entry is stale if alarm's stamp differs
+    };
+    std::vector<AlarmScheduleEntry> alarmHeap;
+    std::vector<Alarm*> alarmActive;
+    bool              alarmScheduleValid;       // false: check all alarms
+
     bool              stopTimeEnabled;  // true if optional property set
 
     int               id;         // unique identifier. used for equality
@@ -260,6 +274,14 @@ namespace ESMCI{
     // called only by friend class Alarm
     int addAlarm(Alarm *alarm);    // alarmCreate(), alarmSet() (TMG 4.1, 4.2)
     int removeAlarm(Alarm *alarm); // alarmDestroy(), alarmSet()
+    void alarmChanged(Alarm *alarm);  // alarm state changed outside advance()
+
+    // alarm schedule
+    static bool alarmScheduleLater(const AlarmScheduleEntry &a,
+                                   const AlarmScheduleEntry &b);
+    bool alarmScheduleUsable(void) const;
+    void alarmSchedule(Alarm *alarm);
+    void alarmScheduleRebuild(void);
 
     friend class Alarm;
 
@@ -22,6 +22,7 @@
 
 #define UINT64T_BIG 18446744073709551615ULL
 #define REGION_MAX_COUNT 65500
+#define TRACE_COUNTER_MAX 8
 
 using std::vector;
 using std::sort;
@@ -42,7 +43,8 @@ namespace ESMCI {
       _local_id(local_id), _isUserRegion(isUserRegion),
       _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
       _mean(0.0), _variance(0.0), _last_entered(0),
-      _time_mpi_start(0), _time_mpi(0), _count_mpi(0) {
+      _time_mpi_start(0), _time_mpi(0), _count_mpi(0),
+      _counters(), _counters_entered(), _counters_valid(false) {
       int localrc;
       if (VM::isInitialized(&localrc)){
         VM *vm = VM::getCurrent(&localrc);
@@ -55,7 +57,8 @@ namespace ESMCI {
       _local_id(0), _isUserRegion(false),
       _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
       _mean(0.0), _variance(0.0), _last_entered(0),
-      _time_mpi_start(0), _time_mpi(0), _count_mpi(0) {
+      _time_mpi_start(0), _time_mpi(0), _count_mpi(0),
+      _counters(), _counters_entered(), _counters_valid(false) {
       int localrc;
       VM *vm = VM::getCurrent(&localrc);
       _pecount = vm->getNcpet(vm->getLocalPet());
@@ -66,7 +69,8 @@ namespace ESMCI {
       _local_id(0), _isUserRegion(false),
       _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
       _mean(0.0), _variance(0.0), _last_entered(0),
-      _time_mpi_start(0), _time_mpi(0), _count_mpi(0) {
+      _time_mpi_start(0), _time_mpi(0), _count_mpi(0),
+      _counters(), _counters_entered(), _counters_valid(false) {
       if (nextGlobalId) {
 	_global_id = next_global_id();
       }
@@ -80,7 +84,8 @@ namespace ESMCI {
       _local_id(0), _isUserRegion(false),
       _pecount(0), _count(0), _total(0), _min(UINT64T_BIG), _max(0),
       _mean(0.0), _variance(0.0), _last_entered(0),
-      _time_mpi_start(0), _time_mpi(0), _count_mpi(0) {
+      _time_mpi_start(0), _time_mpi(0), _count_mpi(0),
+      _counters(), _counters_entered(), _counters_valid(false) {
       
       deserialize(deserializeBuffer, bufferSize);
       
@@ -97,7 +102,10 @@ namespace ESMCI {
       _mean(toClone->getMean()), _variance(toClone->_variance),
       _last_entered(0), _time_mpi_start(0),
       _time_mpi(toClone->getTotalMPI()),
-      _count_mpi(toClone->getCountMPI())  {
+      _count_mpi(toClone->getCountMPI()),
+      _counters(), _counters_entered(), _counters_valid(false) {
+
+      memcpy(_counters, toClone->_counters, sizeof(_counters));
 
       //deep clone children
       for (unsigned i = 0; i < toClone->_children.size(); i++) {
@@ -228,6 +236,26 @@ namespace ESMCI {
       _variance += delta * (val - _mean) ;
     }
 
+    ///// Counters //////
+    // a visit whose counters could not be read on entry or exit
+    // does not add to the counters
+    void enteredCounters(const uint64_t *values, int n, bool valid) {
+      _counters_valid = valid;
+      if (valid) memcpy(_counters_entered, values, n * sizeof(uint64_t));
+    }
+
+    void exitedCounters(const uint64_t *values, int n, bool valid) {
+      if (!valid || !_counters_valid) return;
+      _counters_valid = false;
+      for (int i = 0; i < n; i++) {
+        _counters[i] += values[i] - _counters_entered[i];
+      }
+    }
+
+    uint64_t getCounter(int i) const {
+      return _counters[i];
+    }
+
     uint64_t getTotal() const {
       return _total;
     }
@@ -311,6 +339,9 @@ namespace ESMCI {
          
       _count += other.getCount();
       _total += other.getTotal();
+      for (int i = 0; i < TRACE_COUNTER_MAX; i++) {
+        _counters[i] += other._counters[i];
+      }
       if (_min > other.getMin()) {
 	_min = other.getMin();
       }
@@ -422,6 +453,9 @@ namespace ESMCI {
       memcpy(buffer+(*offset), (const void *) &_variance, sizeof(_variance));
       *offset += sizeof(_variance);
 
+      memcpy(buffer+(*offset), (const void *) _counters, sizeof(_counters));
+      *offset += sizeof(_counters);
+
       int userRegion = 0;
       if (_isUserRegion) userRegion = 1;
 
@@ -566,6 +600,9 @@ namespace ESMCI {
       memcpy( (void *) &_variance, buffer+(*offset), sizeof(_variance) );
       *offset += sizeof(_variance);
 
+      memcpy( (void *) _counters, buffer+(*offset), sizeof(_counters) );
+      *offset += sizeof(_counters);
+
       int userRegion = 0;
       memcpy( (void *) &userRegion, buffer+(*offset), sizeof(userRegion) );
       *offset += sizeof(userRegion);
@@ -603,6 +640,7 @@ namespace ESMCI {
         sizeof(_max) +
         sizeof(_mean) +
         sizeof(_variance) +
+        sizeof(_counters) +
         sizeof(int) + // isUserRegion flag
         sizeof(size_t) +  // records length of name
         strlen(_name.c_str()) + 1;  // length of name
@@ -675,6 +713,10 @@ namespace ESMCI {
     uint64_t _time_mpi;
     size_t _count_mpi;
 
+    //hardware/OS counters accumulated over all visits
+    uint64_t _counters[TRACE_COUNTER_MAX];
+    uint64_t _counters_entered[TRACE_COUNTER_MAX];
+    bool _counters_valid;
     
     
   };
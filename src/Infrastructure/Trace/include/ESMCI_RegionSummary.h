@@ -37,7 +37,8 @@ namespace ESMCI {
       _pet_count(0), _pe_count(0), _count_each(0), _counts_match(true),
       _total_sum(0),
       _total_min(UINT64T_BIG), _total_min_pet(-1),
-      _total_max(0), _total_max_pet(-1) {}
+      _total_max(0), _total_max_pet(-1),
+      _counter_sum() {}
     
     ~RegionSummary() {
       while (!_children.empty()) {
@@ -120,6 +121,15 @@ namespace ESMCI {
       return _total_max_pet;
     }
 
+    double getCounterMean(int i) const {
+      if (_pet_count > 0) {
+	return (double) _counter_sum[i] / _pet_count;
+      }
+      else {
+	return 0.0;
+      }
+    }
+
     size_t getPetCount() const {
       return _pet_count;
     }
@@ -178,6 +188,10 @@ namespace ESMCI {
 	_total_max = rn.getTotal();
 	_total_max_pet = pet;
       }
+
+      for (int i = 0; i < TRACE_COUNTER_MAX; i++) {
+        _counter_sum[i] += rn.getCounter(i);
+      }
       
       //recursively merge child nodes
       mergeChildren(rn, pet);
@@ -213,6 +227,7 @@ namespace ESMCI {
     int      _total_min_pet; //PET with min total
     uint64_t _total_max;     //max of all totals
     int      _total_max_pet; //PET with max total
+    uint64_t _counter_sum[TRACE_COUNTER_MAX]; //sum of each counter over PETs
     
   };
 
@@ -61,6 +61,11 @@ namespace ESMCI {
   uint64_t TraceGetClock(void *data);
   void TraceClockLatch(struct esmftrc_platform_filesys_ctx *ctx);
   void TraceClockUnlatch(struct esmftrc_platform_filesys_ctx *ctx);
+  void TraceInitializeCounters(bool profileLocalPet, int *rc);
+  void TraceFinalizeCounters();
+  int TraceCounterCount();
+  const char *TraceCounterName(int i);
+  bool TraceReadCounters(uint64_t *values);
   void TraceOpen(std::string trace_dir, int *profileToLog, int *rc);
   void TraceClose(int *rc);
   bool TraceInitialized();
@@ -108,6 +113,7 @@ namespace ESMCI {
   void TraceEventMemInfo();
   void TraceEventClock(int *ep_year, int *ep_month, int *ep_day,
                        int *ep_hour, int *ep_minute, int *ep_second);
+  void TraceProfileSnapshot(int *rc);
 
 }
 
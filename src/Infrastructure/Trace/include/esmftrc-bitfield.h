@@ -87,14 +87,14 @@ do {									\
 									\
 	/* Trim v high bits */						\
 	if (__length < sizeof(__v) * CHAR_BIT)				\
-		__v &= ~((~(_vtype) 0) << __length);		\
+		__v &= ~(((_vtype) ~(_vtype) 0) << __length);		\
 									\
 	/* We can now append v with a simple "or", shift it piece-wise */ \
 	this_unit = start_unit;						\
 	if (start_unit == end_unit - 1) {				\
-		mask = ~((~(type) 0) << (__start % ts));		\
+		mask = ~(((type) ~(type) 0) << (__start % ts));		\
 		if (end % ts)						\
-			mask |= (~(type) 0) << (end % ts);		\
+			mask |= ((type) ~(type) 0) << (end % ts);		\
 		cmask = (type) __v << (__start % ts);			\
 		cmask &= ~mask;						\
 		__ptr[this_unit] &= mask;				\
@@ -103,7 +103,7 @@ do {									\
 	}								\
 	if (__start % ts) {						\
 		cshift = __start % ts;					\
-		mask = ~((~(type) 0) << cshift);			\
+		mask = ~(((type) ~(type) 0) << cshift);			\
 		cmask = (type) __v << cshift;				\
 		cmask &= ~mask;						\
 		__ptr[this_unit] &= mask;				\
@@ -118,7 +118,7 @@ do {									\
 		__start += ts;						\
 	}								\
 	if (end % ts) {							\
-		mask = (~(type) 0) << (end % ts);			\
+		mask = ((type) ~(type) 0) << (end % ts);			\
 		cmask = (type) __v;					\
 		cmask &= ~mask;						\
 		__ptr[this_unit] &= mask;				\
@@ -146,14 +146,14 @@ do {									\
 									\
 	/* Trim v high bits */						\
 	if (__length < sizeof(__v) * CHAR_BIT)				\
-		__v &= ~((~(_vtype) 0) << __length);			\
+		__v &= ~(((_vtype) ~(_vtype) 0) << __length);			\
 									\
 	/* We can now append v with a simple "or", shift it piece-wise */ \
 	this_unit = end_unit - 1;					\
 	if (start_unit == end_unit - 1) {				\
-		mask = ~((~(type) 0) << ((ts - (end % ts)) % ts));	\
+		mask = ~(((type) ~(type) 0) << ((ts - (end % ts)) % ts));	\
 		if (__start % ts)					\
-			mask |= (~((type) 0)) << (ts - (__start % ts));	\
+			mask |= ((type) ~(type) 0) << (ts - (__start % ts));	\
 		cmask = (type) __v << ((ts - (end % ts)) % ts);		\
 		cmask &= ~mask;						\
 		__ptr[this_unit] &= mask;				\
@@ -162,7 +162,7 @@ do {									\
 	}								\
 	if (end % ts) {							\
 		cshift = end % ts;					\
-		mask = ~((~(type) 0) << (ts - cshift));			\
+		mask = ~(((type) ~(type) 0) << (ts - cshift));			\
 		cmask = (type) __v << (ts - cshift);			\
 		cmask &= ~mask;						\
 		__ptr[this_unit] &= mask;				\
@@ -177,7 +177,7 @@ do {									\
 		end -= ts;						\
 	}								\
 	if (__start % ts) {						\
-		mask = (~(type) 0) << (ts - (__start % ts));		\
+		mask = ((type) ~(type) 0) << (ts - (__start % ts));		\
 		cmask = (type) __v;					\
 		cmask &= ~mask;						\
 		__ptr[this_unit] &= mask;				\
@@ -258,6 +258,14 @@ void esmftrc_default_trace_region_profile(
 	double ep_stddev
 );
 
+/* trace (stream "default", event "region_counter") */
+void esmftrc_default_trace_region_counter(
+	struct esmftrc_default_ctx *ctx,
+	uint16_t ep_id,
+	uint64_t ep_total,
+	const char * ep_name
+);
+
 #ifdef __cplusplus
 }
 #endif
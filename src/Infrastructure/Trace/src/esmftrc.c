@@ -1900,3 +1900,104 @@ void esmftrc_default_trace_region_profile(
 	/* commit event */
 	_commit_event(TO_VOID_PTR(ctx));
 }
+
+static uint32_t _get_event_size_default_region_counter(
+	void *vctx,
+	uint16_t ep_id,
+	uint64_t ep_total,
+	const char * ep_name
+)
+{
+	struct esmftrc_ctx *ctx = FROM_VOID_PTR(struct esmftrc_ctx, vctx);
+	uint32_t at = ctx->at;
+
+	/* byte-align entity */
+	_ALIGN(at, 8);
+
+	/* stream event header */
+	{
+		/* align structure */
+		_ALIGN(at, 64);
+
+		/* "id" field */
+		/* field size: 8 (partial total so far: 8) */
+
+		/* "timestamp" field */
+		/* field size: 64 (partial total so far: 128) */
+	}
+
+	/* event payload */
+	{
+
+		/* "id" field */
+		/* field size: 16 (partial total so far: 144) */
+
+		/* "total" field */
+		/* field size: 64 (partial total so far: 256) */
+
+		/* "name" field */
+		at += 256;
+		at += _BYTES_TO_BITS(strlen(ep_name) + 1);
+	}
+
+	return at - ctx->at;
+}
+
+static void _serialize_event_default_region_counter(
+	void *vctx,
+	uint16_t ep_id,
+	uint64_t ep_total,
+	const char * ep_name
+)
+{
+	struct esmftrc_ctx *ctx = FROM_VOID_PTR(struct esmftrc_ctx, vctx);
+	/* stream event header */
+	_serialize_stream_event_header_default(ctx, 14);
+
+	/* event payload */
+	{
+		/* align structure */
+		_ALIGN(ctx->at, 64);
+
+		/* "id" field */
+		_ALIGN(ctx->at, 16);
+		esmftrc_bt_bitfield_write_le(&ctx->buf[_BITS_TO_BYTES(ctx->at)], uint8_t, 0, 16, uint16_t, (uint16_t) ep_id);
+		ctx->at += 16;
+
+		/* "total" field */
+		_ALIGN(ctx->at, 64);
+		esmftrc_bt_bitfield_write_le(&ctx->buf[_BITS_TO_BYTES(ctx->at)], uint8_t, 0, 64, uint64_t, (uint64_t) ep_total);
+		ctx->at += 64;
+
+		/* "name" field */
+		_ALIGN(ctx->at, 8);
+		_write_cstring(ctx, ep_name);
+	}
+
+}
+
+/* trace (stream "default", event "region_counter") */
+void esmftrc_default_trace_region_counter(
+	struct esmftrc_default_ctx *ctx,
+	uint16_t ep_id,
+	uint64_t ep_total,
+	const char * ep_name
+)
+{
+	uint32_t ev_size;
+
+	/* get event size */
+	ev_size = _get_event_size_default_region_counter(TO_VOID_PTR(ctx), ep_id, ep_total, ep_name);
+
+	/* do we have enough space to serialize? */
+	if (!_reserve_event_space(TO_VOID_PTR(ctx), ev_size)) {
+		/* no: forget this */
+		return;
+	}
+
+	/* serialize event */
+	_serialize_event_default_region_counter(TO_VOID_PTR(ctx), ep_id, ep_total, ep_name);
+
+	/* commit event */
+	_commit_event(TO_VOID_PTR(ctx));
+}
@@ -148,6 +148,9 @@ class Fraction
   private:
 //
  // < declare private interface methods here >
+
+    // three-way comparison for the comparison operators
+    int compare(const Fraction &fraction, int *rc) const;
 //
 //EOP
 //-------------------------------------------------------------------------
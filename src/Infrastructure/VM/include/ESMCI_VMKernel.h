@@ -366,6 +366,12 @@ class VMK{
     // and the thread level that the MPI implementation supports.
     static MPI_Comm default_mpi_c;
     static int mpi_thread_level;
+    // Processes set aside as I/O servers (ESMF_RUNTIME_IO_SERVER_PETS):
+    // the communicator across all processes handed to init() (MPI_COMM_NULL
+    // if there are none), their number, and whether this is one of them.
+    static MPI_Comm ioserver_world_c;
+    static int ioserver_pets;
+    static bool ioserver;
     static int mpi_init_outside_esmf;
     static int pre_mpi_init;
     // Static data members that hold command line arguments